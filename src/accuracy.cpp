@@ -0,0 +1,190 @@
+#include "accuracy.h"
+#include "mandelbrot.h"
+#include "color.h"
+#include <complex>
+#include <vector>
+#include <string>
+#include <sstream>
+#include <cstdlib>
+#include <algorithm>
+
+namespace accuracy {
+    std::vector<std::vector<int>> renderIterations(
+        const Viewport& viewport,
+        Kernel kernel
+    ) {
+        const double pixelWidth = mandelbrot::getPixelWidth(
+            viewport.topLeft, viewport.bottomRight, viewport.imgWidth
+        );
+        const int imgHeight = mandelbrot::getImgHeight(
+            viewport.topLeft, viewport.bottomRight, pixelWidth
+        );
+
+        std::vector<std::vector<int>> img(
+            imgHeight, std::vector<int>(viewport.imgWidth)
+        );
+
+        for (int i = 0; i < imgHeight; i++) {
+            for (int j = 0; j < viewport.imgWidth; j++) {
+                const std::complex<double> num = mandelbrot::getPixelPoint(
+                    viewport.topLeft, pixelWidth, i, j
+                );
+
+                img[i][j] = kernel(num, viewport.maxIterations);
+            }
+        }
+
+        return img;
+    }
+
+    Comparison compareIterations(
+        const std::vector<std::vector<int>>& reference,
+        const std::vector<std::vector<int>>& result,
+        int maxIterations,
+        const std::vector<color::Color>& outsideColors
+    ) {
+        Comparison comparison = {};
+
+        const int numRows = reference.size();
+        for (int i = 0; i < numRows; i++) {
+            const int numCols = reference[i].size();
+            for (int j = 0; j < numCols; j++) {
+                comparison.numPixels++;
+
+                const int expected = reference[i][j];
+                const int actual = result[i][j];
+                if (expected == actual) {
+                    continue;
+                }
+
+                comparison.numMismatches++;
+
+                // Treat points in the set as having run for `maxIterations`
+                // so that in/out disagreements count as large errors
+                const int expectedCount = expected < 0 ? maxIterations
+                                                       : expected;
+                const int actualCount = actual < 0 ? maxIterations : actual;
+                comparison.maxIterationError = std::max(
+                    comparison.maxIterationError,
+                    std::abs(expectedCount - actualCount)
+                );
+
+                // Compare colors the same way the renderer would produce
+                // them, using black for points in the set
+                const color::Color c1 = mandelbrot::iterationsToColor(
+                    expected, maxIterations, color::BLACK, outsideColors
+                );
+                const color::Color c2 = mandelbrot::iterationsToColor(
+                    actual, maxIterations, color::BLACK, outsideColors
+                );
+                const int colorError = std::max({
+                    std::abs(c1.r - c2.r),
+                    std::abs(c1.g - c2.g),
+                    std::abs(c1.b - c2.b)
+                });
+                comparison.maxColorError = std::max(
+                    comparison.maxColorError, colorError
+                );
+            }
+        }
+
+        return comparison;
+    }
+
+    std::vector<std::vector<color::Color>> createDiffImage(
+        const std::vector<std::vector<int>>& reference,
+        const std::vector<std::vector<int>>& result
+    ) {
+        std::vector<std::vector<color::Color>> img(reference.size());
+
+        const int numRows = reference.size();
+        for (int i = 0; i < numRows; i++) {
+            const int numCols = reference[i].size();
+            img[i].resize(numCols);
+
+            for (int j = 0; j < numCols; j++) {
+                img[i][j] = reference[i][j] == result[i][j] ? color::BLACK
+                                                            : color::WHITE;
+            }
+        }
+
+        return img;
+    }
+
+    double speedup(const Comparison& comparison) {
+        if (comparison.kernelSeconds <= 0) {
+            return 0.0;
+        }
+
+        return comparison.referenceSeconds / comparison.kernelSeconds;
+    }
+
+    bool passes(const Comparison& comparison, double threshold) {
+        if (comparison.numPixels == 0) {
+            return true;
+        }
+
+        const double mismatchRate
+            = static_cast<double>(comparison.numMismatches)
+              / comparison.numPixels;
+        return mismatchRate <= threshold;
+    }
+
+    bool allPass(
+        const std::vector<Comparison>& comparisons,
+        double threshold
+    ) {
+        for (const Comparison& comparison : comparisons) {
+            if (!comparison.reportOnly && !passes(comparison, threshold)) {
+                return false;
+            }
+        }
+
+        return true;
+    }
+
+    std::string toJson(
+        const std::vector<Comparison>& comparisons,
+        double threshold
+    ) {
+        std::ostringstream oss;
+
+        oss << "{\n";
+        oss << "  \"threshold\": " << threshold << ",\n";
+        oss << "  \"results\": [";
+
+        for (size_t k = 0; k < comparisons.size(); k++) {
+            const Comparison& c = comparisons[k];
+            const bool pass = passes(c, threshold);
+
+            const double mismatchRate = c.numPixels == 0 ? 0.0
+                : static_cast<double>(c.numMismatches) / c.numPixels;
+
+            oss << (k == 0 ? "\n" : ",\n");
+            oss << "    {\n";
+            oss << "      \"kernel\": \"" << c.kernelName << "\",\n";
+            oss << "      \"viewport\": \"" << c.viewportName << "\",\n";
+            oss << "      \"pixels\": " << c.numPixels << ",\n";
+            oss << "      \"mismatches\": " << c.numMismatches << ",\n";
+            oss << "      \"mismatch_rate\": " << mismatchRate << ",\n";
+            oss << "      \"max_iteration_error\": "
+                << c.maxIterationError << ",\n";
+            oss << "      \"max_color_error\": " << c.maxColorError << ",\n";
+            oss << "      \"reference_seconds\": "
+                << c.referenceSeconds << ",\n";
+            oss << "      \"kernel_seconds\": " << c.kernelSeconds << ",\n";
+            oss << "      \"speedup\": " << speedup(c) << ",\n";
+            oss << "      \"report_only\": "
+                << (c.reportOnly ? "true" : "false") << ",\n";
+            oss << "      \"pass\": " << (pass ? "true" : "false") << "\n";
+            oss << "    }";
+        }
+
+        oss << "\n  ],\n";
+        oss << "  \"pass\": "
+            << (allPass(comparisons, threshold) ? "true" : "false") << "\n";
+        oss << "}\n";
+
+        return oss.str();
+    }
+}
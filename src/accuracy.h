@@ -0,0 +1,137 @@
+#ifndef ACCURACY_H
+#define ACCURACY_H
+
+#include "color.h"
+#include <complex>
+#include <vector>
+#include <string>
+
+namespace accuracy {
+    /**
+     * @brief Function that counts iterations for a single point, with the
+     *        same contract as `mandelbrot::mandelbrotIterations`
+     */
+    using Kernel = int (*)(std::complex<double>, int);
+
+    /**
+     * @brief Region of the complex plane to render and compare
+     */
+    struct Viewport {
+        std::string name;
+        std::complex<double> topLeft;
+        std::complex<double> bottomRight;
+        int imgWidth;
+        int maxIterations;
+    };
+
+    /**
+     * @brief Result of comparing one kernel against the reference path on
+     *        one viewport
+     */
+    struct Comparison {
+        std::string kernelName;
+        std::string viewportName;
+        long long numPixels;
+        long long numMismatches;
+        int maxIterationError;
+        int maxColorError;
+        double referenceSeconds;
+        double kernelSeconds;
+        // Whether the kernel is known to be inexact, in which case it is
+        // reported but does not fail the run
+        bool reportOnly;
+    };
+
+    /**
+     * @brief Render the iteration count of every pixel in a viewport, using
+     *        `mandelbrot::getPixelPoint` to map pixels to points like the
+     *        renderers do
+     *
+     * @param viewport Region to render
+     * @param kernel Function used to count iterations for each pixel
+     * @return 2D vector of iteration counts
+     */
+    std::vector<std::vector<int>> renderIterations(
+        const Viewport& viewport,
+        Kernel kernel
+    );
+
+    /**
+     * @brief Compare the iteration counts of a kernel against the reference
+     *        iteration counts, both per pixel and after coloring
+     *
+     * @param reference Iteration counts from the reference path
+     * @param result Iteration counts from the kernel under test
+     * @param maxIterations Max number of iterations used for both renders
+     * @param outsideColors Gradient used to color points outside the set
+     * @return Comparison with mismatch and error fields filled in; names and
+     *         timings are left for the caller
+     */
+    Comparison compareIterations(
+        const std::vector<std::vector<int>>& reference,
+        const std::vector<std::vector<int>>& result,
+        int maxIterations,
+        const std::vector<color::Color>& outsideColors
+    );
+
+    /**
+     * @brief Create an image highlighting the pixels where two renders
+     *        disagree
+     *
+     * @param reference Iteration counts from the reference path
+     * @param result Iteration counts from the kernel under test
+     * @return 2D vector of colors, white where the iteration counts differ
+     *         and black where they match
+     */
+    std::vector<std::vector<color::Color>> createDiffImage(
+        const std::vector<std::vector<int>>& reference,
+        const std::vector<std::vector<int>>& result
+    );
+
+    /**
+     * @brief Get how many times faster a kernel was than the reference path
+     *
+     * @param comparison Comparison with timings filled in
+     * @return Reference time divided by kernel time, or 0 if the kernel
+     *         finished faster than the clock could measure
+     */
+    double speedup(const Comparison& comparison);
+
+    /**
+     * @brief Check whether a comparison is within the mismatch threshold
+     *
+     * @param comparison Comparison to check
+     * @param threshold Largest allowed fraction of mismatched pixels
+     * @return `true` if the fraction of mismatched pixels does not exceed
+     *         `threshold`, `false` otherwise
+     */
+    bool passes(const Comparison& comparison, double threshold);
+
+    /**
+     * @brief Check whether a set of comparisons should let a fast path be
+     *        turned on, ignoring report-only kernels
+     *
+     * @param comparisons Comparisons to check
+     * @param threshold Largest allowed fraction of mismatched pixels
+     * @return `true` if every comparison that is not report-only passes,
+     *         `false` otherwise
+     */
+    bool allPass(
+        const std::vector<Comparison>& comparisons,
+        double threshold
+    );
+
+    /**
+     * @brief Serialize comparisons as a JSON report
+     *
+     * @param comparisons Comparisons to include in the report
+     * @param threshold Largest allowed fraction of mismatched pixels
+     * @return JSON document
+     */
+    std::string toJson(
+        const std::vector<Comparison>& comparisons,
+        double threshold
+    );
+}
+
+#endif
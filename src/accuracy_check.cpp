@@ -0,0 +1,99 @@
+#include <iostream>
+#include <string>
+#include <vector>
+#include "accuracy.h"
+#include "color.h"
+
+namespace {
+    const int MAX_ITERATIONS = 10;
+
+    // Two colors make the gradient a single linear ramp, so expected color
+    // errors are easy to work out by hand
+    const std::vector<color::Color> GRAYSCALE = {color::BLACK, color::WHITE};
+
+    int numFailures = 0;
+
+    void check(bool condition, const std::string& message) {
+        if (!condition) {
+            std::cerr << "FAILED: " << message << std::endl;
+            numFailures++;
+        }
+    }
+
+    accuracy::Comparison makeComparison(
+        long long numPixels,
+        long long numMismatches,
+        bool reportOnly
+    ) {
+        accuracy::Comparison comparison = {};
+        comparison.numPixels = numPixels;
+        comparison.numMismatches = numMismatches;
+        comparison.reportOnly = reportOnly;
+        return comparison;
+    }
+}
+
+int main() {
+    const std::vector<std::vector<int>> reference = {
+        {0, 5, -1},
+        {3, 3, 3}
+    };
+
+    // Identical renders have no errors
+    const accuracy::Comparison same = accuracy::compareIterations(
+        reference, reference, MAX_ITERATIONS, GRAYSCALE
+    );
+    check(same.numPixels == 6, "identical renders count every pixel");
+    check(same.numMismatches == 0, "identical renders have no mismatches");
+    check(same.maxIterationError == 0 && same.maxColorError == 0,
+          "identical renders have no error");
+
+    // One escape-time difference (5 vs 7) and one point the kernel wrongly
+    // puts outside the set (-1 vs 4)
+    const std::vector<std::vector<int>> result = {
+        {0, 7, 4},
+        {3, 3, 3}
+    };
+    const accuracy::Comparison diff = accuracy::compareIterations(
+        reference, result, MAX_ITERATIONS, GRAYSCALE
+    );
+    check(diff.numPixels == 6, "mismatched renders count every pixel");
+    check(diff.numMismatches == 2, "both differing pixels are mismatches");
+
+    // The in/out disagreement counts the in-set point as MAX_ITERATIONS,
+    // so its error is 10 - 4 = 6, larger than 7 - 5 = 2
+    check(diff.maxIterationError == 6,
+          "in/out disagreement dominates iteration error");
+
+    // Black inside vs. 40% of the way to white is round(255 * 0.4) = 102,
+    // larger than round(255 * 0.7) - round(255 * 0.5) = 179 - 128 = 51
+    check(diff.maxColorError == 102,
+          "in/out disagreement dominates color error");
+
+    const std::vector<std::vector<color::Color>> diffImage
+        = accuracy::createDiffImage(reference, result);
+    check(diffImage[0][1].r == 255 && diffImage[0][2].r == 255
+          && diffImage[0][0].r == 0 && diffImage[1][0].r == 0,
+          "diff image is white exactly where renders differ");
+
+    // The threshold is inclusive: 1 mismatch in 4 pixels is exactly 0.25
+    const accuracy::Comparison quarter = makeComparison(4, 1, false);
+    check(accuracy::passes(quarter, 0.25), "rate equal to threshold passes");
+    check(!accuracy::passes(quarter, 0.24), "rate above threshold fails");
+
+    // Report-only kernels never fail the run, but gating kernels do
+    const accuracy::Comparison failingReportOnly = makeComparison(4, 4, true);
+    check(accuracy::allPass({quarter, failingReportOnly}, 0.25),
+          "failing report-only kernel does not fail the run");
+    check(!accuracy::allPass({quarter, failingReportOnly}, 0.24),
+          "failing gating kernel fails the run");
+    check(accuracy::toJson({quarter, failingReportOnly}, 0.24).find(
+              "  \"pass\": false\n}") != std::string::npos,
+          "JSON report records the failed run");
+
+    if (numFailures == 0) {
+        std::cout << "All accuracy checks passed" << std::endl;
+    }
+
+    return numFailures == 0 ? 0 : 1;
+}
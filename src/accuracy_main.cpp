@@ -0,0 +1,149 @@
+#include <complex>
+#include <iostream>
+#include <fstream>
+#include <iomanip>
+#include <chrono>
+#include <string>
+#include <vector>
+#include <cstdlib>
+#include "mandelbrot.h"
+#include "accuracy.h"
+#include "color.h"
+#include "bmp.h"
+
+namespace {
+    struct NamedKernel {
+        std::string name;
+        accuracy::Kernel kernel;
+        bool reportOnly;
+    };
+
+    int earlyOutIterations(std::complex<double> num, int maxIterations) {
+        if (mandelbrot::isInCardioidOrBulb(num)) {
+            return -1;
+        }
+
+        return mandelbrot::mandelbrotIterationsFast(num, maxIterations);
+    }
+
+    double secondsSince(std::chrono::steady_clock::time_point start) {
+        const std::chrono::duration<double> elapsed
+            = std::chrono::steady_clock::now() - start;
+        return elapsed.count();
+    }
+
+    void printUsage(const char* program) {
+        std::cerr << "Usage: " << program
+                  << " [--threshold RATE] [--json FILE] [--diff-images]"
+                  << std::endl;
+    }
+}
+
+int main(int argc, char* argv[]) {
+    // Largest fraction of mismatched pixels allowed before the run fails
+    double threshold = 0.001;
+    std::string jsonFile = "accuracy_report.json";
+    bool writeDiffImages = false;
+
+    for (int i = 1; i < argc; i++) {
+        const std::string arg = argv[i];
+        if (arg == "--threshold" && i + 1 < argc) {
+            threshold = std::atof(argv[++i]);
+        } else if (arg == "--json" && i + 1 < argc) {
+            jsonFile = argv[++i];
+        } else if (arg == "--diff-images") {
+            writeDiffImages = true;
+        } else {
+            printUsage(argv[0]);
+            return 2;
+        }
+    }
+
+    // Open the report before rendering, so a bad path fails immediately
+    std::ofstream ofs(jsonFile);
+    if (!ofs) {
+        std::cerr << "Could not open " << jsonFile << std::endl;
+        return 1;
+    }
+
+    const std::vector<accuracy::Viewport> viewports = {
+        {"full", {-2, 1.25}, {1, -1.25}, 600, 100},
+        {"seahorse", {-1.15, 0.4}, {-0.85, 0.2}, 600, 500},
+        {"elephant", {0.25, 0.1}, {0.35, 0.0}, 600, 1000},
+        {"deep", {-0.7436, 0.1319}, {-0.7434, 0.1317}, 400, 2000}
+    };
+
+    const std::vector<NamedKernel> kernels = {
+        {"fast", mandelbrot::mandelbrotIterationsFast, false},
+        // Single precision runs out of bits on deep zooms, so it is only
+        // reported until it has a fallback to double precision
+        {"float", mandelbrot::mandelbrotIterationsFloat, true},
+        {"early_out", earlyOutIterations, false}
+    };
+
+    std::vector<accuracy::Comparison> comparisons;
+
+    std::cout << std::left << std::setw(12) << "kernel"
+              << std::setw(12) << "viewport"
+              << std::right << std::setw(12) << "mismatches"
+              << std::setw(10) << "max iter"
+              << std::setw(11) << "max color"
+              << std::setw(10) << "speedup"
+              << std::setw(7) << "pass" << std::endl;
+
+    for (const accuracy::Viewport& viewport : viewports) {
+        auto start = std::chrono::steady_clock::now();
+        const std::vector<std::vector<int>> reference
+            = accuracy::renderIterations(
+                viewport, mandelbrot::mandelbrotIterations
+            );
+        const double referenceSeconds = secondsSince(start);
+
+        for (const NamedKernel& k : kernels) {
+            start = std::chrono::steady_clock::now();
+            const std::vector<std::vector<int>> result
+                = accuracy::renderIterations(viewport, k.kernel);
+            const double kernelSeconds = secondsSince(start);
+
+            accuracy::Comparison comparison = accuracy::compareIterations(
+                reference, result, viewport.maxIterations, color::BLUE_ORANGE
+            );
+            comparison.kernelName = k.name;
+            comparison.viewportName = viewport.name;
+            comparison.referenceSeconds = referenceSeconds;
+            comparison.kernelSeconds = kernelSeconds;
+            comparison.reportOnly = k.reportOnly;
+
+            const bool pass = accuracy::passes(comparison, threshold);
+            std::cout << std::left << std::setw(12) << k.name
+                      << std::setw(12) << viewport.name
+                      << std::right << std::setw(12)
+                      << comparison.numMismatches
+                      << std::setw(10) << comparison.maxIterationError
+                      << std::setw(11) << comparison.maxColorError
+                      << std::setw(9) << std::fixed << std::setprecision(2)
+                      << accuracy::speedup(comparison) << "x"
+                      << std::setw(7) << (pass ? "yes" : "NO")
+                      << (k.reportOnly ? " (report only)" : "") << std::endl;
+            std::cout.unsetf(std::ios::floatfield);
+
+            if (writeDiffImages && comparison.numMismatches > 0) {
+                bmp::exportMatrix(
+                    accuracy::createDiffImage(reference, result),
+                    "diff_" + k.name + "_" + viewport.name
+                );
+            }
+
+            comparisons.push_back(comparison);
+        }
+    }
+
+    ofs << accuracy::toJson(comparisons, threshold);
+    ofs.close();
+    if (!ofs) {
+        std::cerr << "Could not write " << jsonFile << std::endl;
+        return 1;
+    }
+
+    return accuracy::allPass(comparisons, threshold) ? 0 : 1;
+}
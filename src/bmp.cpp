@@ -14,13 +14,9 @@ namespace bmp {
         const int height = img.size();
         const int width = img[0].size();
 
-        // Must pad out each row so the number of bytes in each row is a
-        // multiple of 4
-        const int widthInBytes = width * BYTES_PER_PIXEL;
-        const int paddingSize = (4 - (widthInBytes % 4)) % 4;
-
         // True width of the image array, accounting for padding
-        const int stride = widthInBytes + paddingSize;
+        const int stride = getStride(width);
+        const int paddingSize = stride - (width * BYTES_PER_PIXEL);
 
         // Open file for output in binary mode
         std::ofstream ofs;
@@ -55,12 +51,30 @@ namespace bmp {
         ofs.close();
     }
 
+    int getStride(int width) {
+        // Must pad out each row so the number of bytes in each row is a
+        // multiple of 4
+        const int widthInBytes = width * BYTES_PER_PIXEL;
+        const int paddingSize = (4 - (widthInBytes % 4)) % 4;
+
+        return widthInBytes + paddingSize;
+    }
+
+    long long getFileSize(int height, int stride) {
+        return FILE_HEADER_SIZE + INFO_HEADER_SIZE
+               + (static_cast<long long>(stride) * height);
+    }
+
     std::array<unsigned char, FILE_HEADER_SIZE> createFileHeader(
         int height, 
         int stride
     ) {
-        const int fileSize = FILE_HEADER_SIZE + INFO_HEADER_SIZE 
-                             + (stride * height);
+        // The size field is only 32 bits wide. Readers ignore it in favor of
+        // the info header, so leave it as 0 when the image is too large.
+        long long fileSize = getFileSize(height, stride);
+        if (fileSize > 0xFFFFFFFFLL) {
+            fileSize = 0;
+        }
 
         std::array<unsigned char, FILE_HEADER_SIZE> fileHeader = {
             0,0,      // signature (always "BM")
@@ -23,6 +23,24 @@ namespace bmp {
         const std::string& fileName
     );
 
+    /**
+     * @brief Get the number of bytes in one row of the pixel array,
+     *        including the padding that rounds it up to a multiple of 4
+     * 
+     * @param width Width of image, in pixels
+     * @return Stride of image, in bytes
+     */
+    int getStride(int width);
+
+    /**
+     * @brief Get the total size of a .bmp file, including headers
+     * 
+     * @param height Height of image, in pixels
+     * @param stride Stride of image (width plus padding), in bytes
+     * @return File size, in bytes
+     */
+    long long getFileSize(int height, int stride);
+
     /**
      * @brief Create a .bmp file header
      * 
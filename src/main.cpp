@@ -1,21 +1,95 @@
 #include <complex>
 #include <iostream>
+#include <string>
 #include <vector>
+#include <cstdlib>
+#include <stdexcept>
 #include "mandelbrot.h"
 #include "color.h"
 #include "bmp.h"
+#include "tiles.h"
+
+namespace {
+    void printUsage(const char* program) {
+        std::cerr << "Usage: " << program
+                  << " [--width N] [--max-iterations N] [--output NAME]"
+                  << " [--tiled [--raw] [--working-set BYTES]]"
+                  << std::endl;
+    }
+}
+
+int main(int argc, char* argv[]) {
+    int imgWidth = 3000;
+    int maxIterations = 100;
+    std::string fileName = "mandelbrot_img";
+
+    // Tiled mode renders straight into a memory-mapped file, for images too
+    // large to fit in memory. Interrupted renders resume when rerun.
+    bool tiled = false;
+    bool raw = false;
+    long long workingSetBytes = tiles::DEFAULT_WORKING_SET_BYTES;
+
+    for (int i = 1; i < argc; i++) {
+        const std::string arg = argv[i];
+        if (arg == "--width" && i + 1 < argc) {
+            imgWidth = std::atoi(argv[++i]);
+        } else if (arg == "--max-iterations" && i + 1 < argc) {
+            maxIterations = std::atoi(argv[++i]);
+        } else if (arg == "--output" && i + 1 < argc) {
+            fileName = argv[++i];
+        } else if (arg == "--tiled") {
+            tiled = true;
+        } else if (arg == "--raw") {
+            raw = true;
+        } else if (arg == "--working-set" && i + 1 < argc) {
+            workingSetBytes = std::atoll(argv[++i]);
+        } else {
+            printUsage(argv[0]);
+            return 2;
+        }
+    }
+
+    if (imgWidth <= 0 || maxIterations <= 0 || workingSetBytes <= 0
+        || (raw && !tiled)) {
+        printUsage(argv[0]);
+        return 2;
+    }
+
+    // std::complex<double> topLeft(-1.15, 0.4);
+    // std::complex<double> bottomRight(-0.85, 0.2);
+    const std::complex<double> topLeft(-2, 1.25);
+    const std::complex<double> bottomRight(1, -1.25);
+
+    if (tiled) {
+        try {
+            if (raw) {
+                tiles::exportMandelbrotIterations(
+                    topLeft, bottomRight, imgWidth, maxIterations, fileName,
+                    workingSetBytes
+                );
+            } else {
+                tiles::exportColoredMandelbrot(
+                    topLeft, bottomRight, imgWidth, maxIterations,
+                    color::BLACK, color::BLUE_ORANGE, fileName,
+                    workingSetBytes
+                );
+            }
+        } catch (const std::exception& e) {
+            std::cerr << e.what() << std::endl;
+            return 1;
+        }
+
+        return 0;
+    }
 
-int main() {
     const std::vector<std::vector<color::Color>> img = mandelbrot::generateColoredMandelbrot(
-        // std::complex<double>(-1.15, 0.4),
-        // std::complex<double>(-0.85, 0.2),
-        std::complex<double>(-2, 1.25),
-        std::complex<double>(1, -1.25),
-        3000,
-        100,
+        topLeft,
+        bottomRight,
+        imgWidth,
+        maxIterations,
         color::BLACK,
         color::BLUE_ORANGE
     );
 
-    bmp::exportMatrix(img, "mandelbrot_img");
+    bmp::exportMatrix(img, fileName);
 }
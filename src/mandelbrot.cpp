@@ -30,6 +30,77 @@ namespace mandelbrot {
         return -1;
     }
 
+    int mandelbrotIterationsFast(std::complex<double> num, int maxIterations) {
+        const double cReal = num.real();
+        const double cImag = num.imag();
+        double zReal = 0;
+        double zImag = 0;
+
+        for (int i = 0; i < maxIterations; i++) {
+            // (a + bi)^2 = (a^2 - b^2) + 2abi
+            const double nextReal = (zReal * zReal) - (zImag * zImag) + cReal;
+            zImag = (2 * zReal * zImag) + cImag;
+            zReal = nextReal;
+
+            // |z| > 2 is equivalent to |z|^2 > 4
+            if ((zReal * zReal) + (zImag * zImag) > 4) {
+                return i;
+            }
+        }
+
+        return -1;
+    }
+
+    int mandelbrotIterationsFloat(std::complex<double> num, int maxIterations) {
+        const float cReal = static_cast<float>(num.real());
+        const float cImag = static_cast<float>(num.imag());
+        float zReal = 0;
+        float zImag = 0;
+
+        for (int i = 0; i < maxIterations; i++) {
+            const float nextReal = (zReal * zReal) - (zImag * zImag) + cReal;
+            zImag = (2 * zReal * zImag) + cImag;
+            zReal = nextReal;
+
+            if ((zReal * zReal) + (zImag * zImag) > 4) {
+                return i;
+            }
+        }
+
+        return -1;
+    }
+
+    bool isInCardioidOrBulb(std::complex<double> num) {
+        const double x = num.real();
+        const double y = num.imag();
+
+        // Main cardioid: q(q + (x - 1/4)) <= y^2 / 4, where
+        // q = (x - 1/4)^2 + y^2
+        const double q = ((x - 0.25) * (x - 0.25)) + (y * y);
+        if (q * (q + (x - 0.25)) <= 0.25 * y * y) {
+            return true;
+        }
+
+        // Period-2 bulb: circle of radius 1/4 centered at -1
+        return ((x + 1) * (x + 1)) + (y * y) <= 0.0625;
+    }
+
+    color::Color iterationsToColor(
+        int numIterations,
+        int maxIterations,
+        color::Color insideColor,
+        const std::vector<color::Color>& outsideColors
+    ) {
+        if (numIterations < 0) {
+            // Number does not grow infinitely - it's in the set
+            return insideColor;
+        }
+
+        // Number grows infinitely - it's outside the set
+        const double pct = static_cast<double>(numIterations) / maxIterations;
+        return color::polylinearGradient(outsideColors, pct);
+    }
+
     double getPixelWidth(
         std::complex<double> topLeft,
         std::complex<double> bottomRight,
@@ -52,6 +123,23 @@ namespace mandelbrot {
         return static_cast<int>(verticalDistance / pixelWidth);
     }
 
+    std::complex<double> getPixelPoint(
+        std::complex<double> topLeft,
+        double pixelWidth,
+        int row,
+        int col
+    ) {
+        // Because image coordinates start at (0, 0), we offset the starting
+        // point to start at the top left. Real part (analogous to x-value)
+        // increases (goes from left to right) starting from offset
+        const double real = (col * pixelWidth) + topLeft.real();
+        // Imaginary part (analogous to y-balue) decreases (goes from top to
+        // bottom) starting from offset
+        const double imag = -(row * pixelWidth) + topLeft.imag();
+
+        return std::complex<double>(real, imag);
+    }
+
     std::vector<std::vector<bool>> generateBinaryMandelbrot(
         std::complex<double> topLeft, 
         std::complex<double> bottomRight,
@@ -64,24 +152,14 @@ namespace mandelbrot {
         // Get image height based on pixel width
         const int imgHeight = getImgHeight(topLeft, bottomRight, pixelWidth);
 
-        // Because image coordinates start at (0, 0), we offset the starting
-        // point to start at the top left
-        const double offsetReal = topLeft.real();
-        const double offsetImag = topLeft.imag();
-
         std::vector<std::vector<bool>> img(
             imgHeight, std::vector<bool>(imgWidth)
         );
 
         for (int i = 0; i < imgHeight; i++) {
             for (int j = 0; j < imgWidth; j++) {
-                // Real part (analogous to x-value) increases (goes from left
-                // to right) starting from offset
-                const double real = (j * pixelWidth) + offsetReal;
-                // Imaginary part (analogous to y-balue) decreases (goes from
-                // top to bottom) starting from offset
-                const double imag = -(i * pixelWidth) + offsetImag;
-                const std::complex<double> num(real, imag);
+                const std::complex<double> num
+                    = getPixelPoint(topLeft, pixelWidth, i, j);
 
                 img[i][j] = isInMandelbrot(num, maxIterations);
             }
@@ -102,24 +180,14 @@ namespace mandelbrot {
         // Get image height based on pixel width
         const int imgHeight = getImgHeight(topLeft, bottomRight, pixelWidth);
 
-        // Because image coordinates start at (0, 0), we offset the starting
-        // point to start at the top left
-        const double offsetReal = topLeft.real();
-        const double offsetImag = topLeft.imag();
-
         std::vector<std::vector<double>> img(
             imgHeight, std::vector<double>(imgWidth)
         );
 
         for (int i = 0; i < imgHeight; i++) {
             for (int j = 0; j < imgWidth; j++) {
-                // Real part (analogous to x-value) increases (goes from left
-                // to right) starting from offset
-                const double real = (j * pixelWidth) + offsetReal;
-                // Imaginary part (analogous to y-balue) decreases (goes from
-                // top to bottom) starting from offset
-                const double imag = -(i * pixelWidth) + offsetImag;
-                const std::complex<double> num(real, imag);
+                const std::complex<double> num
+                    = getPixelPoint(topLeft, pixelWidth, i, j);
 
                 int numIterations = mandelbrotIterations(num, maxIterations);
 
@@ -152,36 +220,20 @@ namespace mandelbrot {
         // Get image height based on pixel width
         const int imgHeight = getImgHeight(topLeft, bottomRight, pixelWidth);
 
-        // Because image coordinates start at (0, 0), we offset the starting
-        // point to start at the top left
-        const double offsetReal = topLeft.real();
-        const double offsetImag = topLeft.imag();
-
         std::vector<std::vector<color::Color>> img(
             imgHeight, std::vector<color::Color>(imgWidth)
         );
 
         for (int i = 0; i < imgHeight; i++) {
             for (int j = 0; j < imgWidth; j++) {
-                // Real part (analogous to x-value) increases (goes from left
-                // to right) starting from offset
-                const double real = (j * pixelWidth) + offsetReal;
-                // Imaginary part (analogous to y-balue) decreases (goes from
-                // top to bottom) starting from offset
-                const double imag = -(i * pixelWidth) + offsetImag;
-                const std::complex<double> num(real, imag);
+                const std::complex<double> num
+                    = getPixelPoint(topLeft, pixelWidth, i, j);
 
                 int numIterations = mandelbrotIterations(num, maxIterations);
 
-                if (numIterations < 0) {
-                    // Number does not grow infinitely - it's in the set
-                    img[i][j] = insideColor;
-                } else {
-                    // Number grows infinitely - it's outside the set
-                    const double pct = static_cast<double>(numIterations)
-                                       / maxIterations;
-                    img[i][j] = color::polylinearGradient(outsideColors, pct);
-                }
+                img[i][j] = iterationsToColor(
+                    numIterations, maxIterations, insideColor, outsideColors
+                );
             }
         }
 
@@ -36,6 +36,57 @@ namespace mandelbrot {
      */
     int mandelbrotIterations(std::complex<double> num, int maxIterations);
 
+    /**
+     * @brief Same as `mandelbrotIterations`, but iterates on the real and
+     *        imaginary parts directly and compares the squared magnitude
+     *        against 4, avoiding `std::pow` and the square root in
+     *        `std::abs`
+     * 
+     * @param num Complex number, value of `c` in `mandelbrot` function
+     * @param maxIterations Max number of iterations for `mandelbrot` function
+     * @return Number of iterations, between 0 and `maxIterations`, for `num`
+     *         to become greater than 2, or -1 if `num` never grows beyond 2
+     */
+    int mandelbrotIterationsFast(std::complex<double> num, int maxIterations);
+
+    /**
+     * @brief Same as `mandelbrotIterationsFast`, but in single precision
+     * 
+     * @param num Complex number, value of `c` in `mandelbrot` function
+     * @param maxIterations Max number of iterations for `mandelbrot` function
+     * @return Number of iterations, between 0 and `maxIterations`, for `num`
+     *         to become greater than 2, or -1 if `num` never grows beyond 2
+     */
+    int mandelbrotIterationsFloat(std::complex<double> num, int maxIterations);
+
+    /**
+     * @brief Test if a complex number lies in the main cardioid or the
+     *        period-2 bulb, both of which are entirely inside the set
+     * 
+     * @param num Complex number, value of `c` in `mandelbrot` function
+     * @return `true` if `num` is in the main cardioid or period-2 bulb,
+     *         `false` otherwise
+     */
+    bool isInCardioidOrBulb(std::complex<double> num);
+
+    /**
+     * @brief Get the color of a point from its iteration count
+     * 
+     * @param numIterations Iteration count, as returned by
+     *                      `mandelbrotIterations`
+     * @param maxIterations Max number of iterations for `mandelbrot` function
+     * @param insideColor Color representing points inside the set
+     * @param outsideColors Colors that form a gradient which will be sampled
+     *                      to represent points outside the set
+     * @return Color of the point
+     */
+    color::Color iterationsToColor(
+        int numIterations,
+        int maxIterations,
+        color::Color insideColor,
+        const std::vector<color::Color>& outsideColors
+    );
+
     /**
      * @brief Get the width of a pixel based on the image width and bounds of
      *        the image in the complex plane
@@ -71,6 +122,23 @@ namespace mandelbrot {
         double pixelWidth
     );
 
+    /**
+     * @brief Get the point in the complex plane represented by a pixel
+     * 
+     * @param topLeft Top left point (i.e., number with highest imaginary
+     *                part and lowest real part)
+     * @param pixelWidth Width of a pixel, in units of the complex plane
+     * @param row Row of the pixel, starting from 0 at the top
+     * @param col Column of the pixel, starting from 0 at the left
+     * @return Point represented by the pixel
+     */
+    std::complex<double> getPixelPoint(
+        std::complex<double> topLeft,
+        double pixelWidth,
+        int row,
+        int col
+    );
+
     /**
      * @brief Generate a graphical representation of the Mandelbrot set
      * 
@@ -0,0 +1,175 @@
+#include "mappedfile.h"
+#include <string>
+#include <cstddef>
+#include <stdexcept>
+
+#ifdef _WIN32
+#include <windows.h>
+#else
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <sys/types.h>
+#include <unistd.h>
+#endif
+
+namespace mappedfile {
+    unsigned char* Region::data() const {
+        return start;
+    }
+
+#ifdef _WIN32
+    long long getFileSize(const std::string& path) {
+        WIN32_FILE_ATTRIBUTE_DATA attributes;
+        if (!GetFileAttributesExA(
+                path.c_str(), GetFileExInfoStandard, &attributes)) {
+            return -1;
+        }
+
+        return (static_cast<long long>(attributes.nFileSizeHigh) << 32)
+               | attributes.nFileSizeLow;
+    }
+
+    File::File(const std::string& path, long long size) {
+        handle = CreateFileA(
+            path.c_str(), GENERIC_READ | GENERIC_WRITE, 0, nullptr,
+            OPEN_ALWAYS, FILE_ATTRIBUTE_NORMAL, nullptr
+        );
+        if (handle == INVALID_HANDLE_VALUE) {
+            throw std::runtime_error("Could not open " + path);
+        }
+
+        // Unlike ftruncate, SetEndOfFile allocates the disk space, so a full
+        // disk is reported here rather than while writing through the mapping
+        LARGE_INTEGER distance;
+        distance.QuadPart = size;
+        if (!SetFilePointerEx(handle, distance, nullptr, FILE_BEGIN)
+            || !SetEndOfFile(handle)) {
+            CloseHandle(handle);
+            throw std::runtime_error("Could not resize " + path);
+        }
+
+        mapping = CreateFileMappingA(
+            handle, nullptr, PAGE_READWRITE,
+            static_cast<DWORD>(size >> 32),
+            static_cast<DWORD>(size & 0xFFFFFFFF),
+            nullptr
+        );
+        if (mapping == nullptr) {
+            CloseHandle(handle);
+            throw std::runtime_error("Could not map " + path);
+        }
+    }
+
+    File::~File() {
+        CloseHandle(mapping);
+        CloseHandle(handle);
+    }
+
+    Region::Region(const File& file, long long offset, std::size_t length)
+        : file(file) {
+        SYSTEM_INFO info;
+        GetSystemInfo(&info);
+        const long long granularity = info.dwAllocationGranularity;
+
+        baseOffset = offset - (offset % granularity);
+        baseLength = length + (offset - baseOffset);
+
+        base = MapViewOfFile(
+            file.mapping, FILE_MAP_WRITE,
+            static_cast<DWORD>(baseOffset >> 32),
+            static_cast<DWORD>(baseOffset & 0xFFFFFFFF),
+            baseLength
+        );
+        if (base == nullptr) {
+            throw std::runtime_error("Could not map file region");
+        }
+
+        start = static_cast<unsigned char*>(base) + (offset - baseOffset);
+    }
+
+    Region::~Region() {
+        UnmapViewOfFile(base);
+    }
+
+    void Region::flush() const {
+        if (!FlushViewOfFile(base, baseLength)
+            || !FlushFileBuffers(file.handle)) {
+            throw std::runtime_error("Could not write file region to disk");
+        }
+    }
+#else
+    long long getFileSize(const std::string& path) {
+        struct stat info;
+        if (stat(path.c_str(), &info) != 0) {
+            return -1;
+        }
+
+        return static_cast<long long>(info.st_size);
+    }
+
+    File::File(const std::string& path, long long size) {
+        fd = open(path.c_str(), O_RDWR | O_CREAT, 0644);
+        if (fd < 0) {
+            throw std::runtime_error("Could not open " + path);
+        }
+
+        if (ftruncate(fd, static_cast<off_t>(size)) != 0) {
+            close(fd);
+            throw std::runtime_error("Could not resize " + path);
+        }
+
+        // ftruncate alone leaves the file sparse, and running out of disk
+        // while writing through a mapping raises SIGBUS instead of an error.
+        // Reserve the blocks now so a full disk is reported here.
+        if (size > 0
+            && posix_fallocate(fd, 0, static_cast<off_t>(size)) != 0) {
+            close(fd);
+            throw std::runtime_error(
+                "Could not reserve disk space for " + path
+            );
+        }
+    }
+
+    File::~File() {
+        close(fd);
+    }
+
+    Region::Region(const File& file, long long offset, std::size_t length)
+        : file(file) {
+        const long long pageSize = sysconf(_SC_PAGESIZE);
+
+        baseOffset = offset - (offset % pageSize);
+        baseLength = length + (offset - baseOffset);
+
+        base = mmap(
+            nullptr, baseLength, PROT_READ | PROT_WRITE, MAP_SHARED,
+            file.fd, static_cast<off_t>(baseOffset)
+        );
+        if (base == MAP_FAILED) {
+            throw std::runtime_error("Could not map file region");
+        }
+
+        start = static_cast<unsigned char*>(base) + (offset - baseOffset);
+    }
+
+    Region::~Region() {
+        munmap(base, baseLength);
+
+#ifdef POSIX_FADV_DONTNEED
+        // Once unmapped, let the page cache drop any clean pages instead of
+        // keeping the whole image resident
+        posix_fadvise(
+            file.fd, static_cast<off_t>(baseOffset),
+            static_cast<off_t>(baseLength), POSIX_FADV_DONTNEED
+        );
+#endif
+    }
+
+    void Region::flush() const {
+        if (msync(base, baseLength, MS_SYNC) != 0) {
+            throw std::runtime_error("Could not write file region to disk");
+        }
+    }
+#endif
+}
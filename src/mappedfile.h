@@ -0,0 +1,99 @@
+#ifndef MAPPEDFILE_H
+#define MAPPEDFILE_H
+
+#include <string>
+#include <cstddef>
+
+namespace mappedfile {
+    /**
+     * @brief Get the size of a file
+     *
+     * @param path Path of file
+     * @return File size, in bytes, or -1 if the file does not exist
+     */
+    long long getFileSize(const std::string& path);
+
+    /**
+     * @brief Open file that can be mapped into memory. The file is closed
+     *        when this object is destroyed.
+     */
+    class File {
+    public:
+        /**
+         * @brief Open a file for reading and writing, creating it if it does
+         *        not exist, and resize it to exactly `size` bytes. Existing
+         *        contents within `size` are kept, and disk space for the
+         *        whole file is reserved up front.
+         *
+         * @param path Path of file
+         * @param size Size of file, in bytes
+         * @throws std::runtime_error if the file cannot be opened or resized,
+         *         or there is not enough disk space for it
+         */
+        File(const std::string& path, long long size);
+        ~File();
+
+        File(const File&) = delete;
+        File& operator=(const File&) = delete;
+
+    private:
+        friend class Region;
+
+#ifdef _WIN32
+        void* handle;
+        void* mapping;
+#else
+        int fd;
+#endif
+    };
+
+    /**
+     * @brief Range of a file that is mapped into memory for writing. The
+     *        range is unmapped when this object is destroyed, and the system
+     *        is told its pages are no longer needed.
+     */
+    class Region {
+    public:
+        /**
+         * @brief Map a range of a file into memory for writing
+         *
+         * @param file Open file, which must outlive this region
+         * @param offset Offset of the range from the start of the file, in
+         *               bytes
+         * @param length Length of the range, in bytes
+         * @throws std::runtime_error if the range cannot be mapped
+         */
+        Region(const File& file, long long offset, std::size_t length);
+        ~Region();
+
+        Region(const Region&) = delete;
+        Region& operator=(const Region&) = delete;
+
+        /**
+         * @brief Get the start of the requested range
+         */
+        unsigned char* data() const;
+
+        /**
+         * @brief Write the region back to disk, blocking until the write
+         *        completes
+         *
+         * @throws std::runtime_error if the region cannot be written back
+         */
+        void flush() const;
+
+    private:
+        const File& file;
+
+        // Start of the requested range
+        unsigned char* start;
+
+        // Start and length of the actual mapping, which begins at an offset
+        // aligned to the system's mapping granularity
+        void* base;
+        std::size_t baseLength;
+        long long baseOffset;
+    };
+}
+
+#endif
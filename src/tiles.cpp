@@ -0,0 +1,350 @@
+#include "tiles.h"
+#include "mandelbrot.h"
+#include "mappedfile.h"
+#include "color.h"
+#include "bmp.h"
+#include <complex>
+#include <vector>
+#include <string>
+#include <fstream>
+#include <sstream>
+#include <iomanip>
+#include <functional>
+#include <array>
+#include <algorithm>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <stdexcept>
+
+namespace {
+    /**
+     * @brief Layout of the pixel data in an output file
+     */
+    struct Layout {
+        // Bytes before the first row of pixel data
+        long long dataOffset;
+        // Bytes per row, including padding
+        int stride;
+        int imgHeight;
+        // Whether the last row of the image is stored first, as in .bmp files
+        bool bottomUp;
+    };
+
+    // Width of the finished row count in a checkpoint file, so it can be
+    // overwritten in place
+    const int CHECKPOINT_COUNT_WIDTH = 10;
+
+    /**
+     * @brief Load the number of finished rows from a checkpoint file, or
+     *        start a new checkpoint file if it is missing or was written for
+     *        a different render
+     *
+     * Progress is kept as a count of rows rather than tiles, so a render can
+     * be resumed with a different working set.
+     *
+     * @param path Path of checkpoint file
+     * @param key Description of the render parameters
+     * @param imgHeight Height of image, in pixels
+     * @param canResume Whether the output file from the earlier render is
+     *                  still there. If not, the checkpoint is started over.
+     * @return Number of finished rows, counted in file order
+     * @throws std::runtime_error if the checkpoint file cannot be written
+     */
+    int loadCheckpoint(
+        const std::string& path,
+        const std::string& key,
+        int imgHeight,
+        bool canResume
+    ) {
+        std::ifstream ifs(path, std::ios::binary);
+        std::string savedKey;
+        std::string count;
+        if (canResume && ifs && std::getline(ifs, savedKey) && savedKey == key
+            && std::getline(ifs, count)
+            && static_cast<int>(count.size()) == CHECKPOINT_COUNT_WIDTH
+            && count.find_first_not_of("0123456789") == std::string::npos) {
+            const long long rowsDone = std::atoll(count.c_str());
+            if (rowsDone <= imgHeight) {
+                return static_cast<int>(rowsDone);
+            }
+        }
+        ifs.close();
+
+        std::ofstream ofs(path, std::ios::binary | std::ios::trunc);
+        ofs << key << '\n' << std::string(CHECKPOINT_COUNT_WIDTH, '0') << '\n';
+        ofs.close();
+        if (!ofs) {
+            throw std::runtime_error("Could not write " + path);
+        }
+
+        return 0;
+    }
+
+    /**
+     * @brief Render an image into a memory-mapped file in bands of rows,
+     *        checkpointing each band once it is on disk
+     *
+     * @param path Path of output file
+     * @param key Description of the render parameters, used to tell whether
+     *            an existing checkpoint belongs to this render
+     * @param header Bytes written at the start of the file
+     * @param layout Layout of the pixel data
+     * @param workingSetBytes Max number of bytes mapped at once
+     * @param maxTiles Max number of tiles to render in this call, or -1 for
+     *                 no limit
+     * @param renderRow Function that renders one image row into a buffer of
+     *                  `layout.stride` bytes
+     * @return `true` if the image is complete, `false` if tiles remain
+     */
+    bool renderTiles(
+        const std::string& path,
+        const std::string& key,
+        const std::vector<unsigned char>& header,
+        const Layout& layout,
+        long long workingSetBytes,
+        int maxTiles,
+        const std::function<void(int, unsigned char*)>& renderRow
+    ) {
+        const int tileRows = static_cast<int>(std::max(
+            1LL,
+            std::min(
+                workingSetBytes / layout.stride,
+                static_cast<long long>(layout.imgHeight)
+            )
+        ));
+
+        const long long fileSize = layout.dataOffset
+            + (static_cast<long long>(layout.stride) * layout.imgHeight);
+
+        // The output file is part of the key, so a checkpoint is never
+        // applied to a different file. The tile size is not, since progress
+        // is counted in rows.
+        std::ostringstream fullKey;
+        fullKey << key << " output=" << path << " size=" << fileSize;
+
+        // Finished rows can only be trusted if the file they were written to
+        // is still there
+        const bool canResume = mappedfile::getFileSize(path) == fileSize;
+
+        const std::string checkpointPath = path + ".checkpoint";
+        int rowsDone = loadCheckpoint(
+            checkpointPath, fullKey.str(), layout.imgHeight, canResume
+        );
+
+        std::fstream checkpoint(
+            checkpointPath, std::ios::binary | std::ios::in | std::ios::out
+        );
+        if (!checkpoint) {
+            throw std::runtime_error("Could not open " + checkpointPath);
+        }
+        const long long countOffset = fullKey.str().size() + 1;
+
+        mappedfile::File file(path, fileSize);
+
+        if (!header.empty()) {
+            mappedfile::Region region(file, 0, header.size());
+            std::copy(header.begin(), header.end(), region.data());
+            region.flush();
+        }
+
+        int numRendered = 0;
+
+        // Tiles are visited in file order rather than image order, so that
+        // write-back to disk is sequential and finished work is always a
+        // prefix of the file
+        while (rowsDone < layout.imgHeight) {
+            if (numRendered == maxTiles) {
+                return false;
+            }
+
+            const int firstRow = rowsDone;
+            const int numRows = std::min(tileRows, layout.imgHeight - firstRow);
+
+            {
+                mappedfile::Region region(
+                    file,
+                    layout.dataOffset
+                        + (static_cast<long long>(firstRow) * layout.stride),
+                    static_cast<std::size_t>(numRows) * layout.stride
+                );
+
+                for (int r = 0; r < numRows; r++) {
+                    const int fileRow = firstRow + r;
+                    const int imgRow = layout.bottomUp
+                                       ? layout.imgHeight - 1 - fileRow
+                                       : fileRow;
+
+                    renderRow(
+                        imgRow,
+                        region.data()
+                            + (static_cast<std::size_t>(r) * layout.stride)
+                    );
+                }
+
+                // Only count the rows as done once their pages are on disk
+                region.flush();
+            }
+
+            rowsDone += numRows;
+            checkpoint.seekp(countOffset);
+            checkpoint << std::setw(CHECKPOINT_COUNT_WIDTH)
+                       << std::setfill('0') << rowsDone;
+            checkpoint.flush();
+            if (!checkpoint) {
+                throw std::runtime_error("Could not write " + checkpointPath);
+            }
+
+            numRendered++;
+        }
+
+        checkpoint.close();
+        std::remove(checkpointPath.c_str());
+
+        return true;
+    }
+
+    /**
+     * @brief Describe the region of the complex plane being rendered
+     */
+    std::string describeRender(
+        std::complex<double> topLeft,
+        std::complex<double> bottomRight,
+        int imgWidth,
+        int maxIterations
+    ) {
+        std::ostringstream oss;
+        oss << std::setprecision(17)
+            << "topLeft=" << topLeft.real() << "," << topLeft.imag()
+            << " bottomRight=" << bottomRight.real() << ","
+            << bottomRight.imag()
+            << " width=" << imgWidth
+            << " maxIterations=" << maxIterations;
+
+        return oss.str();
+    }
+}
+
+namespace tiles {
+    bool exportColoredMandelbrot(
+        std::complex<double> topLeft,
+        std::complex<double> bottomRight,
+        int imgWidth,
+        int maxIterations,
+        color::Color insideColor,
+        const std::vector<color::Color>& outsideColors,
+        const std::string& fileName,
+        long long workingSetBytes,
+        int maxTiles
+    ) {
+        const double pixelWidth = mandelbrot::getPixelWidth(
+            topLeft, bottomRight, imgWidth
+        );
+        const int imgHeight = mandelbrot::getImgHeight(
+            topLeft, bottomRight, pixelWidth
+        );
+        const int stride = bmp::getStride(imgWidth);
+
+        const std::array<unsigned char, bmp::FILE_HEADER_SIZE> fileHeader
+            = bmp::createFileHeader(imgHeight, stride);
+        const std::array<unsigned char, bmp::INFO_HEADER_SIZE> infoHeader
+            = bmp::createInfoHeader(imgHeight, imgWidth);
+
+        std::vector<unsigned char> header(fileHeader.begin(), fileHeader.end());
+        header.insert(header.end(), infoHeader.begin(), infoHeader.end());
+
+        // Colors are part of the key, since changing them changes the output
+        std::ostringstream key;
+        key << "bmp "
+            << describeRender(topLeft, bottomRight, imgWidth, maxIterations)
+            << " colors=" << static_cast<int>(insideColor.r) << ","
+            << static_cast<int>(insideColor.g) << ","
+            << static_cast<int>(insideColor.b);
+        for (const color::Color& c : outsideColors) {
+            key << ";" << static_cast<int>(c.r) << ","
+                << static_cast<int>(c.g) << "," << static_cast<int>(c.b);
+        }
+
+        const Layout layout = {
+            bmp::FILE_HEADER_SIZE + bmp::INFO_HEADER_SIZE,
+            stride,
+            imgHeight,
+            true
+        };
+
+        return renderTiles(
+            fileName + ".bmp", key.str(), header, layout, workingSetBytes,
+            maxTiles,
+            [&](int i, unsigned char* row) {
+                for (int j = 0; j < imgWidth; j++) {
+                    const std::complex<double> num
+                        = mandelbrot::getPixelPoint(topLeft, pixelWidth, i, j);
+
+                    const color::Color c = mandelbrot::iterationsToColor(
+                        mandelbrot::mandelbrotIterations(num, maxIterations),
+                        maxIterations, insideColor, outsideColors
+                    );
+
+                    // Write B, G, R values
+                    row[(j * bmp::BYTES_PER_PIXEL)    ] = c.b;
+                    row[(j * bmp::BYTES_PER_PIXEL) + 1] = c.g;
+                    row[(j * bmp::BYTES_PER_PIXEL) + 2] = c.r;
+                }
+
+                // Write padding
+                for (int k = imgWidth * bmp::BYTES_PER_PIXEL; k < stride; k++) {
+                    row[k] = 0;
+                }
+            }
+        );
+    }
+
+    bool exportMandelbrotIterations(
+        std::complex<double> topLeft,
+        std::complex<double> bottomRight,
+        int imgWidth,
+        int maxIterations,
+        const std::string& fileName,
+        long long workingSetBytes,
+        int maxTiles
+    ) {
+        const double pixelWidth = mandelbrot::getPixelWidth(
+            topLeft, bottomRight, imgWidth
+        );
+        const int imgHeight = mandelbrot::getImgHeight(
+            topLeft, bottomRight, pixelWidth
+        );
+
+        const std::string key = "raw " + describeRender(
+            topLeft, bottomRight, imgWidth, maxIterations
+        );
+
+        const Layout layout = {
+            0,
+            imgWidth * BYTES_PER_ITERATION,
+            imgHeight,
+            false
+        };
+
+        return renderTiles(
+            fileName + ".raw", key, {}, layout, workingSetBytes, maxTiles,
+            [&](int i, unsigned char* row) {
+                for (int j = 0; j < imgWidth; j++) {
+                    const std::complex<double> num
+                        = mandelbrot::getPixelPoint(topLeft, pixelWidth, i, j);
+
+                    const uint32_t n = static_cast<uint32_t>(
+                        mandelbrot::mandelbrotIterations(num, maxIterations)
+                    );
+
+                    // Write little-endian regardless of host byte order
+                    unsigned char* out = row + (j * BYTES_PER_ITERATION);
+                    out[0] = static_cast<unsigned char>(n      );
+                    out[1] = static_cast<unsigned char>(n >>  8);
+                    out[2] = static_cast<unsigned char>(n >> 16);
+                    out[3] = static_cast<unsigned char>(n >> 24);
+                }
+            }
+        );
+    }
+}
@@ -0,0 +1,101 @@
+#ifndef TILES_H
+#define TILES_H
+
+#include "color.h"
+#include <complex>
+#include <vector>
+#include <string>
+
+namespace tiles {
+    // Default limit on how much of the output file is mapped at once
+    const long long DEFAULT_WORKING_SET_BYTES = 256LL * 1024 * 1024;
+    const int BYTES_PER_ITERATION = 4;
+
+    /**
+     * @brief Render a colored representation of the Mandelbrot set directly
+     *        into a memory-mapped .bmp file, one tile at a time, so the image
+     *        never has to fit in memory
+     *
+     * Tiles are bands of whole rows rendered in file order, so pages are
+     * written back sequentially. The number of finished rows is recorded in
+     * a `<fileName>.bmp.checkpoint` file. If a render with the same
+     * parameters is interrupted, calling this function again skips the
+     * finished rows, as long as the output file is still there, even if
+     * `workingSetBytes` has changed. The checkpoint file is removed once the
+     * render finishes.
+     *
+     * @param topLeft Top left point (i.e., number with highest imaginary
+     *                part and lowest real part)
+     * @param bottomRight Bottom right point (i.e., number with lowest
+     *                    imaginary part and highest real part)
+     * @param imgWidth Width of the resulting image (i.e., number of columns)
+     * @param maxIterations Max number of iterations for `mandelbrot` function
+     * @param insideColor Color representing points inside the set
+     * @param outsideColors Colors that form a gradient which will be sampled
+     *                      to represent points outside the set
+     * @param fileName Name of exported file, excluding the `.bmp` file
+     *                 extension
+     * @param workingSetBytes Max number of bytes of the output file mapped
+     *                        into memory at once. At least one row is always
+     *                        mapped.
+     * @param maxTiles Max number of tiles to render in this call, or -1 for
+     *                 no limit. Lets a long render be split across several
+     *                 runs.
+     * @return `true` if the image is complete, `false` if tiles remain to be
+     *         rendered by a later call
+     * @throws std::runtime_error if the output file or checkpoint file
+     *         cannot be written
+     */
+    bool exportColoredMandelbrot(
+        std::complex<double> topLeft,
+        std::complex<double> bottomRight,
+        int imgWidth,
+        int maxIterations,
+        color::Color insideColor,
+        const std::vector<color::Color>& outsideColors,
+        const std::string& fileName,
+        long long workingSetBytes = DEFAULT_WORKING_SET_BYTES,
+        int maxTiles = -1
+    );
+
+    /**
+     * @brief Render the iteration count of every point directly into a
+     *        memory-mapped raw file, one tile at a time, so the image never
+     *        has to fit in memory
+     *
+     * The file has no header. It holds one 32-bit little-endian signed
+     * integer per pixel, as returned by `mandelbrotIterations`, in row-major
+     * order starting from the top left. Tiling and checkpointing work the
+     * same as in `exportColoredMandelbrot`.
+     *
+     * @param topLeft Top left point (i.e., number with highest imaginary
+     *                part and lowest real part)
+     * @param bottomRight Bottom right point (i.e., number with lowest
+     *                    imaginary part and highest real part)
+     * @param imgWidth Width of the resulting image (i.e., number of columns)
+     * @param maxIterations Max number of iterations for `mandelbrot` function
+     * @param fileName Name of exported file, excluding the `.raw` file
+     *                 extension
+     * @param workingSetBytes Max number of bytes of the output file mapped
+     *                        into memory at once. At least one row is always
+     *                        mapped.
+     * @param maxTiles Max number of tiles to render in this call, or -1 for
+     *                 no limit. Lets a long render be split across several
+     *                 runs.
+     * @return `true` if the image is complete, `false` if tiles remain to be
+     *         rendered by a later call
+     * @throws std::runtime_error if the output file or checkpoint file
+     *         cannot be written
+     */
+    bool exportMandelbrotIterations(
+        std::complex<double> topLeft,
+        std::complex<double> bottomRight,
+        int imgWidth,
+        int maxIterations,
+        const std::string& fileName,
+        long long workingSetBytes = DEFAULT_WORKING_SET_BYTES,
+        int maxTiles = -1
+    );
+}
+
+#endif
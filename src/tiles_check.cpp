@@ -0,0 +1,173 @@
+#include <complex>
+#include <iostream>
+#include <fstream>
+#include <iterator>
+#include <string>
+#include <vector>
+#include <cstdio>
+#include "mandelbrot.h"
+#include "color.h"
+#include "bmp.h"
+#include "tiles.h"
+
+namespace {
+    const std::complex<double> TOP_LEFT(-2, 1.25);
+    const std::complex<double> BOTTOM_RIGHT(1, -1.25);
+    const int IMG_WIDTH = 301;
+    const int MAX_ITERATIONS = 100;
+
+    // Small enough that the image is split into many tiles
+    const long long WORKING_SET_BYTES = 10000;
+
+    // Offset of the last image row, which is the first row of the first tile
+    const int PIXEL_OFFSET = bmp::FILE_HEADER_SIZE + bmp::INFO_HEADER_SIZE;
+
+    int numFailures = 0;
+
+    void check(bool condition, const std::string& message) {
+        if (!condition) {
+            std::cerr << "FAILED: " << message << std::endl;
+            numFailures++;
+        }
+    }
+
+    std::vector<char> readFile(const std::string& path) {
+        std::ifstream ifs(path, std::ios::binary);
+        return std::vector<char>(
+            std::istreambuf_iterator<char>(ifs),
+            std::istreambuf_iterator<char>()
+        );
+    }
+
+    bool fileExists(const std::string& path) {
+        return std::ifstream(path).good();
+    }
+
+    bool exportTiled(
+        const std::string& fileName,
+        int maxTiles,
+        long long workingSetBytes = WORKING_SET_BYTES
+    ) {
+        return tiles::exportColoredMandelbrot(
+            TOP_LEFT, BOTTOM_RIGHT, IMG_WIDTH, MAX_ITERATIONS,
+            color::BLACK, color::BLUE_ORANGE, fileName,
+            workingSetBytes, maxTiles
+        );
+    }
+
+    // Overwrite the first pixel of the first finished tile, which a resumed
+    // render should leave alone
+    void markFirstPixel(const std::string& path, char value) {
+        std::fstream fs(path, std::ios::binary | std::ios::in | std::ios::out);
+        fs.seekp(PIXEL_OFFSET);
+        fs.put(value);
+    }
+}
+
+int main() {
+    bmp::exportMatrix(
+        mandelbrot::generateColoredMandelbrot(
+            TOP_LEFT, BOTTOM_RIGHT, IMG_WIDTH, MAX_ITERATIONS,
+            color::BLACK, color::BLUE_ORANGE
+        ),
+        "tiles_check_reference"
+    );
+    const std::vector<char> reference = readFile("tiles_check_reference.bmp");
+
+    // Tiled output matches the in-memory renderer
+    std::remove("tiles_check_full.bmp");
+    std::remove("tiles_check_full.bmp.checkpoint");
+    check(exportTiled("tiles_check_full", -1), "full render completes");
+    check(readFile("tiles_check_full.bmp") == reference,
+          "tiled .bmp matches exportMatrix");
+    check(!fileExists("tiles_check_full.bmp.checkpoint"),
+          "checkpoint removed after full render");
+
+    // An interrupted render resumes without redoing finished tiles
+    std::remove("tiles_check_resume.bmp");
+    std::remove("tiles_check_resume.bmp.checkpoint");
+    check(!exportTiled("tiles_check_resume", 3), "partial render stops early");
+    check(fileExists("tiles_check_resume.bmp.checkpoint"),
+          "checkpoint kept after partial render");
+    const char marked = static_cast<char>(reference[PIXEL_OFFSET] ^ 0xFF);
+    markFirstPixel("tiles_check_resume.bmp", marked);
+    check(exportTiled("tiles_check_resume", -1), "resumed render completes");
+    std::vector<char> resumed = readFile("tiles_check_resume.bmp");
+    check(resumed.size() == reference.size()
+          && resumed[PIXEL_OFFSET] == marked,
+          "resumed render skips finished tiles");
+    resumed[PIXEL_OFFSET] = reference[PIXEL_OFFSET];
+    check(resumed == reference, "resumed render matches exportMatrix");
+
+    // Progress survives a change of working set between runs
+    std::remove("tiles_check_rebudget.bmp");
+    std::remove("tiles_check_rebudget.bmp.checkpoint");
+    check(!exportTiled("tiles_check_rebudget", 3),
+          "partial render before rebudget stops early");
+    markFirstPixel("tiles_check_rebudget.bmp", marked);
+    check(exportTiled("tiles_check_rebudget", -1, WORKING_SET_BYTES / 4),
+          "render resumed with smaller working set completes");
+    std::vector<char> rebudgeted = readFile("tiles_check_rebudget.bmp");
+    check(rebudgeted.size() == reference.size()
+          && rebudgeted[PIXEL_OFFSET] == marked,
+          "render resumed with smaller working set skips finished rows");
+    rebudgeted[PIXEL_OFFSET] = reference[PIXEL_OFFSET];
+    check(rebudgeted == reference,
+          "render resumed with smaller working set matches exportMatrix");
+
+    // A checkpoint is not trusted once its output file is gone
+    std::remove("tiles_check_deleted.bmp");
+    std::remove("tiles_check_deleted.bmp.checkpoint");
+    exportTiled("tiles_check_deleted", 3);
+    std::remove("tiles_check_deleted.bmp");
+    check(exportTiled("tiles_check_deleted", -1),
+          "render after deleting output completes");
+    check(readFile("tiles_check_deleted.bmp") == reference,
+          "render after deleting output matches exportMatrix");
+
+    // Raw iteration counts match mandelbrotIterations
+    std::remove("tiles_check_raw.raw");
+    std::remove("tiles_check_raw.raw.checkpoint");
+    tiles::exportMandelbrotIterations(
+        TOP_LEFT, BOTTOM_RIGHT, IMG_WIDTH, MAX_ITERATIONS, "tiles_check_raw",
+        WORKING_SET_BYTES
+    );
+    const std::vector<char> raw = readFile("tiles_check_raw.raw");
+    const double pixelWidth = mandelbrot::getPixelWidth(
+        TOP_LEFT, BOTTOM_RIGHT, IMG_WIDTH
+    );
+    const int imgHeight = mandelbrot::getImgHeight(
+        TOP_LEFT, BOTTOM_RIGHT, pixelWidth
+    );
+    bool rawMatches = static_cast<long long>(raw.size())
+        == static_cast<long long>(imgHeight) * IMG_WIDTH
+           * tiles::BYTES_PER_ITERATION;
+    for (int i = 0; rawMatches && i < imgHeight; i++) {
+        for (int j = 0; j < IMG_WIDTH; j++) {
+            const unsigned char* in = reinterpret_cast<const unsigned char*>(
+                raw.data()
+                + ((static_cast<long long>(i) * IMG_WIDTH + j)
+                   * tiles::BYTES_PER_ITERATION)
+            );
+            const int n = static_cast<int>(
+                in[0] | (in[1] << 8) | (in[2] << 16)
+                | (static_cast<unsigned int>(in[3]) << 24)
+            );
+            const int expected = mandelbrot::mandelbrotIterations(
+                mandelbrot::getPixelPoint(TOP_LEFT, pixelWidth, i, j),
+                MAX_ITERATIONS
+            );
+            if (n != expected) {
+                rawMatches = false;
+                break;
+            }
+        }
+    }
+    check(rawMatches, "raw iterations match mandelbrotIterations");
+
+    if (numFailures == 0) {
+        std::cout << "All tile checks passed" << std::endl;
+    }
+
+    return numFailures == 0 ? 0 : 1;
+}